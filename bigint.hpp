@@ -5,8 +5,29 @@
 #include <algorithm>
 #include <cmath>
 #include <iomanip>
+#include <type_traits>
 using namespace std;
 const uint64_t maxdec = 999999999999999999ULL; // The max 18 digits number
+const uint64_t decpower[19] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+                               100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+                               10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+                               100000000000000000ULL, 1000000000000000000ULL}; // decpower[i] = 10^i
+/**
+ * @brief Every built-in integer type of at most 64 bits is forwarded to the int64_t or uint64_t overload according
+ *        to its signedness. Without this, x + 5 would be ambiguous between the int64_t and uint64_t overloads.
+ *        bool and wider integers such as __int128 can't be represented by int64_t or uint64_t, so the operations
+ *        with them are deleted instead of truncating them silently.
+ */
+template <typename T>
+using bigint_scalar = typename conditional<is_signed<T>::value, int64_t, uint64_t>::type;
+template <typename T>
+using bigint_if_scalar =
+    typename enable_if<is_integral<T>::value && !is_same<T, bool>::value && sizeof(T) <= sizeof(uint64_t), int>::type;
+template <typename T>
+using bigint_if_not_scalar = // __int128 is not is_integral in strict ISO mode, so check convertibility instead
+    typename enable_if<is_same<T, bool>::value || (is_convertible<T, int64_t>::value && !is_class<T>::value &&
+                                                   !is_floating_point<T>::value && sizeof(T) > sizeof(uint64_t)),
+                       int>::type;
 
 /**
  * @brief Here I use vector<uint64_t> number to store the big integer. Every element in vector(number) is a (at most)
@@ -24,6 +45,8 @@ class bigint
 public:
     bigint();
     bigint(const int64_t &);
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint(const T &) = delete;
     /**
      * @brief Construct a new bigint object with string
      *
@@ -58,15 +81,92 @@ public:
      */
     bigint &operator*=(const bigint &);
     bigint &operator=(const bigint &);
+    /**
+     * @brief Operations with a native integer. The integer is never converted to a temporary bigint, it is applied
+     *        to number directly in a single pass. The integer may be larger than 18 digits (UINT64_MAX has 20), so
+     *        it is treated as at most 2 elements of number.
+     * @details / truncates toward zero and % takes the sign of the dividend, the same as the built-in integers.
+     * @attention Dividing by 0 throws invalid_argument.
+     */
+    bigint &operator+=(const int64_t &);
+    bigint &operator+=(const uint64_t &);
+    bigint &operator-=(const int64_t &);
+    bigint &operator-=(const uint64_t &);
+    bigint &operator*=(const int64_t &);
+    bigint &operator*=(const uint64_t &);
+    bigint &operator/=(const int64_t &);
+    bigint &operator/=(const uint64_t &);
+    bigint &operator%=(const int64_t &);
+    bigint &operator%=(const uint64_t &);
+    template <typename T, bigint_if_scalar<T> = 0>
+    bigint &operator+=(const T &a) { return *this += static_cast<bigint_scalar<T>>(a); }
+    template <typename T, bigint_if_scalar<T> = 0>
+    bigint &operator-=(const T &a) { return *this -= static_cast<bigint_scalar<T>>(a); }
+    template <typename T, bigint_if_scalar<T> = 0>
+    bigint &operator*=(const T &a) { return *this *= static_cast<bigint_scalar<T>>(a); }
+    template <typename T, bigint_if_scalar<T> = 0>
+    bigint &operator/=(const T &a) { return *this /= static_cast<bigint_scalar<T>>(a); }
+    template <typename T, bigint_if_scalar<T> = 0>
+    bigint &operator%=(const T &a) { return *this %= static_cast<bigint_scalar<T>>(a); }
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint &operator+=(const T &) = delete;
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint &operator-=(const T &) = delete;
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint &operator*=(const T &) = delete;
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint &operator/=(const T &) = delete;
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    bigint &operator%=(const T &) = delete;
+    /**
+     * @brief Compare with a native integer without building a bigint.
+     * @return -1 if *this < a, 0 if *this == a, 1 if *this > a
+     */
+    int compare(const int64_t &a) const;
+    int compare(const uint64_t &a) const;
+    template <typename T, bigint_if_scalar<T> = 0>
+    int compare(const T &a) const { return compare(static_cast<bigint_scalar<T>>(a)); }
+    template <typename T, bigint_if_not_scalar<T> = 0>
+    int compare(const T &) const = delete;
+    /**
+     * @brief Multiply or divide by 10^k. Every 18 powers of 10 is exactly one element of number, so k / 18 elements
+     *        are inserted or erased at the front of number and only the left k % 18 powers need one pass over number.
+     *        This costs O(n) instead of calling timessingal k times.
+     * @details div_pow10 truncates toward zero, the same as operator/=.
+     * @example bigint("12345").mul_pow10(2) is 1234500, bigint("-12345").div_pow10(2) is -123
+     */
+    bigint &mul_pow10(const uint64_t &k);
+    bigint &div_pow10(const uint64_t &k);
 
 private:
     vector<uint64_t> number;
     bool positive = true;
+    /**
+     * @brief Kernels of the native integer operations. They only work on the absolute value of the big integer.
+     *        submagnitude is the exception: if |a| < mag, |a| becomes mag - |a| and the sign is reversed. It needs
+     *        number to be non-empty.
+     *        divmagnitude returns the remainder and throws invalid_argument if mag is 0.
+     */
+    void addmagnitude(const uint64_t &mag);
+    void submagnitude(const uint64_t &mag);
+    void mulmagnitude(const uint64_t &mag);
+    uint64_t divmagnitude(const uint64_t &mag);
+    int cmpmagnitude(const uint64_t &mag) const;
+    void addsigned(const uint64_t &mag, bool neg);       // *this += (neg ? -mag : mag)
+    void assignmagnitude(const uint64_t &mag);           // number = mag, split into at most 2 elements
+    void trim();                                         // Pop out the extra 0s. 0 is always positive
+    static uint64_t absolute(const int64_t &a);          // Also correct for INT64_MIN
+    /**
+     * @brief a * b = high * 10^18 + low, for a and b less than 10^18. a and b are split into 9 digits halves, so
+     *        every partial product is less than 10^18 and fits in uint64_t.
+     */
+    static void mulelement(const uint64_t &a, const uint64_t &b, uint64_t &high, uint64_t &low);
     /**
      * @brief This function is more for convenience of implement of operation *=. So user can't get access to this function
      * @param coefficient this parameter should be a 1-digit non-positive number, i.e. 0-9
      * @param power
-     * @details After calling this function, the big integer a will become a*coefficient*10^power
+     * @details After calling this function, the big integer a will become a*coefficient*10^power. The power is
+     *          applied by mul_pow10.
      */
     void timessingal(const uint32_t &, uint64_t);
 };
@@ -80,6 +180,7 @@ bigint operator-(const bigint &big1);
 bigint operator+(bigint big1, const bigint &big2);
 bigint operator-(bigint big1, const bigint &big2);
 bigint operator*(bigint big1, const bigint &big2);
+// Operations with a native integer on either side are templates defined at the end of this file
 ostream &operator<<(ostream &out, const bigint &big);
 
 bigint::bigint()
@@ -89,8 +190,8 @@ bigint::bigint()
 
 bigint::bigint(const int64_t &a)
 {
-    uint64_t temp = static_cast<uint64_t>(a);
-    number.push_back(temp);
+    positive = a >= 0;
+    assignmagnitude(absolute(a)); // a may be negative or longer than 18 digits
 }
 
 bigint::bigint(string s)
@@ -297,6 +398,14 @@ bigint &bigint::operator*=(const bigint &timebig)
 {
     vector<uint64_t> timenum = timebig.getnumber(), resnum;
     vector<uint32_t> digits;
+    if (timenum.size() == 1) // The multiplier is a single element, multiply it directly instead of digit by digit
+    {
+        mulmagnitude(timenum[0]);
+        if (!timebig.getsign())
+            positive = !positive;
+        trim();
+        return *this;
+    }
     bigint res(0), original = *this;
     string temp;
     for (uint64_t i = 0; i < timenum.size(); i++) // Execrate every digit of timenum to digit
@@ -350,34 +459,354 @@ void bigint::timessingal(const uint32_t &coeffi, uint64_t power)
         resnum.push_back(res);
     }
     if (carry != 0)
-    {
         resnum.push_back(carry);
-        carry = 0;
+    number = resnum;
+    mul_pow10(power);
+}
+
+bigint &bigint::operator+=(const int64_t &a)
+{
+    addsigned(absolute(a), a < 0);
+    return *this;
+}
+
+bigint &bigint::operator+=(const uint64_t &a)
+{
+    addsigned(a, false);
+    return *this;
+}
+
+bigint &bigint::operator-=(const int64_t &a)
+{
+    addsigned(absolute(a), a >= 0);
+    return *this;
+}
+
+bigint &bigint::operator-=(const uint64_t &a)
+{
+    addsigned(a, true);
+    return *this;
+}
+
+bigint &bigint::operator*=(const int64_t &a)
+{
+    mulmagnitude(absolute(a));
+    if (a < 0)
+        positive = !positive;
+    trim();
+    return *this;
+}
+
+bigint &bigint::operator*=(const uint64_t &a)
+{
+    mulmagnitude(a);
+    trim();
+    return *this;
+}
+
+bigint &bigint::operator/=(const int64_t &a)
+{
+    divmagnitude(absolute(a));
+    if (a < 0)
+        positive = !positive;
+    trim();
+    return *this;
+}
+
+bigint &bigint::operator/=(const uint64_t &a)
+{
+    divmagnitude(a);
+    trim();
+    return *this;
+}
+
+bigint &bigint::operator%=(const int64_t &a)
+{
+    assignmagnitude(divmagnitude(absolute(a))); // The remainder keeps the sign of the dividend
+    trim();
+    return *this;
+}
+
+bigint &bigint::operator%=(const uint64_t &a)
+{
+    assignmagnitude(divmagnitude(a));
+    trim();
+    return *this;
+}
+
+int bigint::compare(const int64_t &a) const
+{
+    bool neg = !positive && cmpmagnitude(0) != 0; // -0 is not negative
+    if (neg != (a < 0))
+        return neg ? -1 : 1;
+    int res = cmpmagnitude(absolute(a));
+    return neg ? -res : res; // Both negative, the bigger absolute value is the smaller number
+}
+
+int bigint::compare(const uint64_t &a) const
+{
+    if (!positive && cmpmagnitude(0) != 0)
+        return -1;
+    return cmpmagnitude(a);
+}
+
+bigint &bigint::mul_pow10(const uint64_t &k)
+{
+    trim();
+    if (number.size() == 1 && number[0] == 0)
+        return *this;
+    uint64_t shift = k % 18, carry = 0;
+    if (shift != 0)
+    {
+        uint64_t split = decpower[18 - shift]; // Split every element to high digits and low digits. The low digits
+        for (uint64_t i = 0; i < number.size(); i++) // times 10^shift stay in this element, the high digits carry
+        {                                            // to the next element. So the multiplication never overflows
+            uint64_t high = number[i] / split;
+            number[i] = number[i] % split * decpower[shift] + carry;
+            carry = high;
+        }
+        if (carry != 0)
+            number.push_back(carry);
     }
+    number.insert(number.begin(), k / 18, 0); // Whole elements of 0s at the low end
+    return *this;
+}
+
+bigint &bigint::div_pow10(const uint64_t &k)
+{
+    if (k / 18 >= number.size())
+    {
+        number.assign(1, 0);
+        positive = true;
+        return *this;
+    }
+    number.erase(number.begin(), number.begin() + static_cast<ptrdiff_t>(k / 18));
+    uint64_t shift = k % 18, remain = 0;
+    if (shift != 0)
+    {
+        for (uint64_t i = number.size() - 1; i < number.size(); i--) // From high digit, the remainder of every element
+        {                                                             // becomes the high digits of the next lower one
+            uint64_t low = number[i] % decpower[shift];
+            number[i] = number[i] / decpower[shift] + remain * decpower[18 - shift];
+            remain = low;
+        }
+    }
+    trim();
+    return *this;
+}
 
-    while (power != 0)
+void bigint::addmagnitude(const uint64_t &mag)
+{
+    if (number.size() == 0)
+        number.push_back(0);
+    uint64_t carry = mag / (maxdec + 1); // The 19th and 20th digits of mag, at most 18
+    number[0] += mag % (maxdec + 1);
+    if (number[0] > maxdec)
     {
-        for (uint64_t i = 0; i < resnum.size(); i++)
+        number[0] -= (maxdec + 1);
+        carry++;
+    }
+    for (uint64_t i = 1; carry != 0; i++)
+    {
+        if (i == number.size())
         {
-            resnum[i] *= 10;
-            if (carry != 0)
-                resnum[i] += carry;
-            if (resnum[i] > maxdec)
-            {
-                carry = resnum[i] / (maxdec + 1);
-                resnum[i] %= (maxdec + 1);
-            }
-            else
-                carry = 0;
+            number.push_back(carry);
+            break;
         }
-        if (carry != 0)
+        number[i] += carry;
+        if (number[i] > maxdec)
         {
-            resnum.push_back(carry);
+            number[i] -= (maxdec + 1);
+            carry = 1;
+        }
+        else
             carry = 0;
+    }
+}
+
+void bigint::submagnitude(const uint64_t &mag)
+{
+    if (cmpmagnitude(mag) < 0) // |a| < mag, so |a| fits in uint64_t and so does mag - |a|
+    {
+        uint64_t value = number[0];
+        if (number.size() > 1)
+            value += number[1] * (maxdec + 1);
+        assignmagnitude(mag - value);
+        positive = !positive;
+        return;
+    }
+    uint64_t borrow = mag / (maxdec + 1);
+    if (number[0] < mag % (maxdec + 1))
+    {
+        number[0] = number[0] + (maxdec + 1) - mag % (maxdec + 1);
+        borrow++;
+    }
+    else
+        number[0] -= mag % (maxdec + 1);
+    for (uint64_t i = 1; borrow != 0; i++) // |a| >= mag, so the borrow always stops inside number
+    {
+        if (number[i] < borrow)
+        {
+            number[i] = number[i] + (maxdec + 1) - borrow;
+            borrow = 1;
+        }
+        else
+        {
+            number[i] -= borrow;
+            borrow = 0;
         }
-        power--;
     }
-    number = resnum;
+}
+
+void bigint::mulmagnitude(const uint64_t &mag)
+{
+    if (mag == 0)
+    {
+        number.assign(1, 0);
+        return;
+    }
+    uint64_t maghigh = mag / (maxdec + 1), maglow = mag % (maxdec + 1), carry = 0; // mag has 2 elements at most
+    for (uint64_t i = 0; i < number.size(); i++)
+    {
+        uint64_t high, low, original = number[i];
+        mulelement(original, maglow, high, low);
+        low += carry % (maxdec + 1); // Less than 2*10^18, no overflow
+        number[i] = low % (maxdec + 1);
+        // The new carry is (original * mag + carry) / 10^18 <= mag, so it fits in uint64_t. Every term is
+        // non-negative, so no partial sum can overflow either
+        carry = high + original * maghigh + carry / (maxdec + 1) + low / (maxdec + 1);
+    }
+    while (carry != 0)
+    {
+        number.push_back(carry % (maxdec + 1));
+        carry /= (maxdec + 1);
+    }
+}
+
+uint64_t bigint::divmagnitude(const uint64_t &mag)
+{
+    if (mag == 0)
+        throw invalid_argument("Division by zero is not acceptable!");
+    const uint64_t half = 1000000000ULL;          // 10^9
+    if (mag <= 18446744072ULL)                    // remain * 10^9 + 999,999,999 still fits in uint64_t
+    {
+        uint64_t remain = 0;
+        for (uint64_t i = number.size() - 1; i < number.size(); i--) // Long division from high digit, 9 digits
+        {                                                            // at a time
+            uint64_t res = remain * half + number[i] / half;
+            uint64_t quotient = res / mag; // remain < mag, so every quotient is less than 10^9
+            res = res % mag * half + number[i] % half;
+            number[i] = quotient * half + res / mag;
+            remain = res % mag;
+        }
+        return remain;
+    }
+    // A bigger mag: still 9 digits at a time, but remain * 10^9 + 9 digits needs 2 elements. Every quotient is
+    // estimated by dividing the top digits by the top 10 digits of mag plus 1. The estimate is never too big and at
+    // most a few too small, so it is corrected after computing the exact remainder with mulelement
+    uint64_t maghigh = mag / (maxdec + 1), maglow = mag % (maxdec + 1), shift = 0, remain = 0;
+    while (mag / decpower[shift] >= 10000000000ULL) // mag has at least 11 digits, so shift is 1 to 10
+        shift++;
+    uint64_t magtop = mag / decpower[shift] + 1;
+    for (uint64_t i = number.size() - 1; i < number.size(); i--)
+    {
+        uint64_t quotient = 0;
+        for (uint64_t j = 0; j < 2; j++) // The high 9 digits of number[i], then the low 9 digits
+        {
+            uint64_t digits = (j == 0) ? number[i] / half : number[i] % half;
+            uint64_t remhigh = remain / half, remlow = remain % half * half + digits, prodhigh, prodlow;
+            // The top digits are less than 10^9 * mag / 10^shift < 10^19, no overflow
+            uint64_t res = (remhigh * decpower[18 - shift] + remlow / decpower[shift]) / magtop;
+            mulelement(res, maglow, prodhigh, prodlow);
+            prodhigh += res * maghigh;
+            if (remlow < prodlow) // remain * 10^9 + digits - res * mag, never negative
+            {
+                remlow = remlow + (maxdec + 1) - prodlow;
+                remhigh -= prodhigh + 1;
+            }
+            else
+            {
+                remlow -= prodlow;
+                remhigh -= prodhigh;
+            }
+            while (remhigh > maghigh || (remhigh == maghigh && remlow >= maglow)) // Correct the estimate
+            {
+                if (remlow < maglow)
+                {
+                    remlow = remlow + (maxdec + 1) - maglow;
+                    remhigh -= maghigh + 1;
+                }
+                else
+                {
+                    remlow -= maglow;
+                    remhigh -= maghigh;
+                }
+                res++;
+            }
+            remain = remhigh * (maxdec + 1) + remlow; // Less than mag, so it fits in uint64_t
+            quotient = quotient * half + res;
+        }
+        number[i] = quotient;
+    }
+    return remain;
+}
+
+int bigint::cmpmagnitude(const uint64_t &mag) const
+{
+    uint64_t length = number.size(), high = mag / (maxdec + 1), low = mag % (maxdec + 1);
+    while (length > 0 && number[length - 1] == 0) // Ignore the extra 0s
+        length--;
+    uint64_t maglength = (high != 0) ? 2 : ((low != 0) ? 1 : 0);
+    if (length != maglength)
+        return (length < maglength) ? -1 : 1;
+    if (length == 2 && number[1] != high)
+        return (number[1] < high) ? -1 : 1;
+    if (length >= 1 && number[0] != low)
+        return (number[0] < low) ? -1 : 1;
+    return 0;
+}
+
+void bigint::addsigned(const uint64_t &mag, bool neg)
+{
+    trim(); // -0 becomes 0 before the sign is checked
+    if (positive != neg) // Same sign, add the absolute values
+        addmagnitude(mag);
+    else
+        submagnitude(mag);
+    trim();
+}
+
+void bigint::assignmagnitude(const uint64_t &mag)
+{
+    number.clear();
+    number.push_back(mag % (maxdec + 1));
+    if (mag > maxdec)
+        number.push_back(mag / (maxdec + 1));
+}
+
+void bigint::trim()
+{
+    while (number.size() > 1 && number.back() == 0)
+        number.pop_back();
+    if (number.size() == 0)
+        number.push_back(0);
+    if (number.size() == 1 && number[0] == 0)
+        positive = true;
+}
+
+uint64_t bigint::absolute(const int64_t &a)
+{
+    return (a < 0) ? 0 - static_cast<uint64_t>(a) : static_cast<uint64_t>(a);
+}
+
+void bigint::mulelement(const uint64_t &a, const uint64_t &b, uint64_t &high, uint64_t &low)
+{
+    const uint64_t half = 1000000000ULL; // 10^9
+    uint64_t ahigh = a / half, alow = a % half, bhigh = b / half, blow = b % half;
+    uint64_t middle = ahigh * blow + alow * bhigh; // Less than 2*10^18
+    low = alow * blow + middle % half * half;      // Less than 2*10^18
+    high = ahigh * bhigh + middle / half + low / (maxdec + 1);
+    low %= (maxdec + 1);
 }
 
 bool operator>(const bigint &big1, const bigint &big2)
@@ -547,4 +976,125 @@ bigint operator-(bigint big1, const bigint &big2)
 bigint operator*(bigint big1, const bigint &big2)
 {
     return big1 *= big2;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator+(bigint big1, const T &a)
+{
+    return big1 += a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator+(const T &a, bigint big2)
+{
+    return big2 += a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator-(bigint big1, const T &a)
+{
+    return big1 -= a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator-(const T &a, const bigint &big2)
+{
+    bigint res = -big2; // a - big2 = -big2 + a
+    return res += a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator*(bigint big1, const T &a)
+{
+    return big1 *= a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator*(const T &a, bigint big2)
+{
+    return big2 *= a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator/(bigint big1, const T &a)
+{
+    return big1 /= a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bigint operator%(bigint big1, const T &a)
+{
+    return big1 %= a;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator>(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) > 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator>=(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) >= 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator<(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) < 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator<=(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) <= 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator==(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) == 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator!=(const bigint &big1, const T &a)
+{
+    return big1.compare(static_cast<bigint_scalar<T>>(a)) != 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator>(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) < 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator>=(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) <= 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator<(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) > 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator<=(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) >= 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator==(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) == 0;
+}
+
+template <typename T, bigint_if_scalar<T> = 0>
+bool operator!=(const T &a, const bigint &big2)
+{
+    return big2.compare(static_cast<bigint_scalar<T>>(a)) != 0;
 }
\ No newline at end of file
@@ -1,18 +1,30 @@
 #include "bigint.hpp"
 #include <fstream>
 #include <random>
+#include <sstream>
 using namespace std;
 /**
  * @brief Generate a test file.
  * @param x Generate x random numbers from 1 to 1000 digits.
  */
 void generate_test_file(const uint64_t &x);
+/**
+ * @brief Check the operations with native integers and the power-of-ten scaling against answers written by hand.
+ *        Every mismatch is printed.
+ * @return The number of mismatches
+ */
+uint32_t check_scalar_operations();
+/**
+ * @brief Print a mismatch and count it if the result differs from the answer.
+ */
+void check(const string &what, const bigint &result, const string &answer, uint32_t &mismatch);
 /**
  * @brief You can input your own number(Only read from file is acceptable.)
  *        I have provided a function: generate_test_file to automaticaly generate the test file.
  */
 int main()
 {
+    //check_scalar_operations();
     //generate_test_file(10);
     ifstream test("test.txt"); // Read data from file. CHANGE THE NAME OF FILE HERE!
     if (!test.is_open())
@@ -119,3 +131,66 @@ void generate_test_file(const uint64_t &x)
     }
     test.close();
 }
+
+void check(const string &what, const bigint &result, const string &answer, uint32_t &mismatch)
+{
+    ostringstream out;
+    out << result;
+    if (out.str() == answer)
+        return;
+    cout << "Mismatch: " << what << "\n" << out.str() << "\nshould be\n" << answer << "\n";
+    cout << "-------------------------------------------\n";
+    mismatch++;
+}
+
+uint32_t check_scalar_operations()
+{
+    bigint x("123456789012345678901234567890123456788"), y("-123456789012345678901234567890123456788"), scaled;
+    uint32_t mismatch = 0;
+    check("x + 5", x + 5, "123456789012345678901234567890123456793", mismatch);
+    check("y + 5", y + 5, "-123456789012345678901234567890123456783", mismatch);
+    check("x - -5", x - (-5), "123456789012345678901234567890123456793", mismatch);
+    check("5 - x", 5 - x, "-123456789012345678901234567890123456783", mismatch);
+    check("x * -7", x * -7, "-864197523086419752308641975230864197516", mismatch);
+    check("y * -7", y * -7, "864197523086419752308641975230864197516", mismatch);
+    // / truncates toward zero and % takes the sign of the dividend
+    check("x / 3", x / 3, "41152263004115226300411522630041152262", mismatch);
+    check("x % 3", x % 3, "2", mismatch);
+    check("y / 3", y / 3, "-41152263004115226300411522630041152262", mismatch);
+    check("y % 3", y % 3, "-2", mismatch);
+    check("x % -3", x % -3, "2", mismatch);
+    check("y % -3", y % -3, "-2", mismatch);
+    check("x / 1000000000007", x / 1000000000007ULL, "123456789011481481378154197", mismatch);
+    check("x % 1000000000007", x % 1000000000007ULL, "520476377409", mismatch);
+    // The boundaries of int64_t and uint64_t
+    check("x / INT64_MIN", x / INT64_MIN, "-13385211885526973835", mismatch);
+    check("x % INT64_MIN", x % INT64_MIN, "3089367264516473108", mismatch);
+    check("x / UINT64_MAX", x / UINT64_MAX, "6692605942763486918", mismatch);
+    check("y % UINT64_MAX", y % UINT64_MAX, "-558601170425184218", mismatch);
+    check("y + UINT64_MAX", y + UINT64_MAX, "-123456789012345678882787823816413905173", mismatch);
+    check("x * UINT64_MAX", x * UINT64_MAX, "2277375791072698140124934049012493404882574858837308112620", mismatch);
+    check("bigint(INT64_MIN)", bigint(INT64_MIN), "-9223372036854775808", mismatch);
+    check("0 - 5", bigint(0) - 5, "-5", mismatch);
+    // compare returns -1, 0 or 1. -0 equals 0
+    check("x.compare(5)", x.compare(5), "1", mismatch);
+    check("y.compare(-5)", y.compare(-5), "-1", mismatch);
+    check("bigint(INT64_MIN).compare(INT64_MIN)", bigint(INT64_MIN).compare(INT64_MIN), "0", mismatch);
+    check("bigint(0).compare(UINT64_MAX)", bigint(0).compare(UINT64_MAX), "-1", mismatch);
+    check("(-bigint(0)).compare(0)", (-bigint(0)).compare(0), "0", mismatch);
+    check("y < -5", static_cast<int64_t>(y < -5), "1", mismatch);
+    check("-5 < y", static_cast<int64_t>(-5 < y), "0", mismatch);
+    // Scaling by 10^k, including k / 18 >= number of elements
+    scaled = x;
+    check("x * 10^25", scaled.mul_pow10(25), "1234567890123456789012345678901234567880000000000000000000000000", mismatch);
+    scaled = x;
+    check("x / 10^20", scaled.div_pow10(20), "1234567890123456789", mismatch);
+    scaled = y;
+    check("y / 10^20", scaled.div_pow10(20), "-1234567890123456789", mismatch);
+    scaled = y;
+    check("y / 10^54", scaled.div_pow10(54), "0", mismatch);
+    scaled = x;
+    check("x / 10^100", scaled.div_pow10(100), "0", mismatch);
+    if (mismatch == 0)
+        cout << "All the operations with native integers are correct.\n";
+    return mismatch;
+}
\ No newline at end of file